@@ -27,6 +27,8 @@ PLUGINS                    := $(BASEDIR)/plugins.mk
 TEST                       := 0
 DEBUG                      := 0
 PROFILE                    := 0
+LTO                        := 0
+PGO                        := 0
 TRACE                      := 0
 
 # Configure system settings
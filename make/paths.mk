@@ -70,6 +70,11 @@ ifndef TEMPDIR
   endif
 endif
 
+# Profile data for profile-guided optimization, kept outside of the build directory
+ifndef PGO_DIR
+  PGO_DIR                    := $(BASEDIR)/.pgo
+endif
+
 # Set-up list of common variables
 PATH_VARS = \
 	BINDIR \
@@ -77,6 +82,7 @@ PATH_VARS = \
 	ETCDIR \
 	INCDIR \
 	LIBDIR \
+	PGO_DIR \
 	PREFIX \
 	ROOTDIR \
 	SHAREDDIR \
@@ -91,6 +97,7 @@ pathvars:
 	echo "  ETCDIR                    location of system configuration files"
 	echo "  INCDIR                    location of the header files"
 	echo "  LIBDIR                    location of the library"
+	echo "  PGO_DIR                   location of profile data for profile-guided optimization"
 	echo "  PREFIX                    installation prefix for binary files"
 	echo "  SHAREDDIR                 location of the shared files"
 	echo "  TEMPDIR                   location of temporary directory"
@@ -187,6 +187,8 @@ COMMON_VARS = \
 	INSTALL_HEADERS \
 	LIBRARY_EXT \
 	LIBRARY_PREFIX \
+	LTO \
+	PGO \
 	PKGCONFIG_EXT \
 	PLATFORM \
 	ROOT_ARTIFACT_ID \
@@ -213,6 +215,10 @@ sysvars:
 	echo "  INSTALL_HEADERS           install headers (enabled by default)"
 	echo "  LIBRARY_EXT               file extension for library files"
 	echo "  LIBRARY_PREFIX            prefix used for library file"
+	echo "  LTO                       build with link-time optimization"
+	echo "  PGO                       profile-guided optimization stage:"
+	echo "                            - generate - build instrumented binaries for training"
+	echo "                            - use      - build binaries optimized by collected profiles"
 	echo "  PKGCONFIG_EXT             file extension for pkgconfig files"
 	echo "  PLATFORM                  target software platform to perform build"
 	echo "  PROFILE                   build with profile options"
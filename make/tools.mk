@@ -104,6 +104,26 @@ ifeq ($(PROFILE),1)
   CXXFLAGS_EXT       += -pg -DLSP_PROFILE
 endif
 
+# Fat LTO objects are required since modules are merged with 'ld -r' before final linkage
+ifeq ($(LTO),1)
+  CFLAGS_EXT         += -flto=auto -ffat-lto-objects
+  CXXFLAGS_EXT       += -flto=auto -ffat-lto-objects
+  EXE_FLAGS_EXT      += -flto=auto
+  SO_FLAGS_EXT       += -flto=auto
+endif
+
+ifeq ($(PGO),generate)
+  CFLAGS_EXT         += -fprofile-generate="$(PGO_DIR)" -fprofile-update=atomic
+  CXXFLAGS_EXT       += -fprofile-generate="$(PGO_DIR)" -fprofile-update=atomic
+  EXE_FLAGS_EXT      += -fprofile-generate="$(PGO_DIR)"
+  SO_FLAGS_EXT       += -fprofile-generate="$(PGO_DIR)"
+else ifeq ($(PGO),use)
+  CFLAGS_EXT         += -fprofile-use="$(PGO_DIR)" -fprofile-partial-training -Wno-missing-profile
+  CXXFLAGS_EXT       += -fprofile-use="$(PGO_DIR)" -fprofile-partial-training -Wno-missing-profile
+  EXE_FLAGS_EXT      += -fprofile-use="$(PGO_DIR)"
+  SO_FLAGS_EXT       += -fprofile-use="$(PGO_DIR)"
+endif
+
 ifeq ($(TRACE),1)
   CFLAGS_EXT         += -DLSP_TRACE
   CXXFLAGS_EXT       += -DLSP_TRACE